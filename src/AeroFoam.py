@@ -10,6 +10,7 @@
 
 # System modules
 import commands, sys 
+import numpy
 
 # Import C++/Python wrapper (1/2)
 sys.path.append( commands.getoutput( 'echo $FOAM_USER_APPBIN' ) )
@@ -21,6 +22,19 @@ IDMESH = 1
 IDSOLV = 2
 IDINTE = 3
 IDPLUG = 4
+
+# ==============================================================================
+#                                                                        pyView                                           
+# ==============================================================================
+# NumPy array over the name-th array of the id-th class, without copy (scalar 
+# arrays have shape N, vector arrays have shape N x 3). The array is valid until
+# the memory is deallocated with pyEnd
+def pyView( id, name ):
+    view, components, size = wrapper.View( id, name )
+    array = numpy.asarray( view ).view( { 4: numpy.float32, 8: numpy.float64, 16: numpy.longdouble }[size] )
+    if components > 1:
+        array = array.reshape( -1, components )
+    return array
  
 # ==============================================================================
 #                                                                    pyOpenFOAM                                           
@@ -57,6 +71,10 @@ class pySolver:
 
     def next( self ):
         return wrapper.Next( self.id )
+
+    # rho, m, Et, p, U, T, rhsRho, rhsM, rhsEt
+    def view( self, name ):
+        return pyView( self.id, name )
         
 # ==============================================================================
 #                                                                   pyInterface                                      
@@ -69,6 +87,10 @@ class pyInterface:
 
     def next( self ):
         return wrapper.Next( self.id )
+
+    # Fa, Ma, Qa, q, qdot
+    def view( self, name ):
+        return pyView( self.id, name )
         
 # ==============================================================================
 #                                                                      pyPlugin                                      
@@ -83,7 +105,22 @@ class pyPlugin:
         return wrapper.Next( self.id )
         
 # ==============================================================================
-#                                                                      pyPlugin                                      
+#                                                                     pyAdvance                                      
+# ==============================================================================
+# Advance in time all the classes by n timesteps (or until the maximum residual
+# is below tolerance, if positive) without returning to Python at each timestep.
+# The history buffer (n x width) is allocated if not provided, and each row is 
+# [ t, residual, residualRho, residualM, residualEt ] followed, if the interface
+# is active, by [ Fa(3), Ma(3), q(Nq), qdot(Nq), Qa(Nq) ]. The filled rows and 
+# the running flag (False if Time has ended) are returned
+def pyAdvance( n, tolerance = 0.0, history = None ):
+    if history is None:
+        history = numpy.zeros( ( n, wrapper.History() ) )
+    steps, running = wrapper.Advance( n, tolerance, history )
+    return history[:steps], running
+
+# ==============================================================================
+#                                                                         pyEnd                                      
 # ==============================================================================
 # Python wrapper for memory deallocation. Deallocation order is critical
 class pyEnd:
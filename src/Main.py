@@ -14,7 +14,9 @@ Aero    = pySolver()
 Elastic = pyInterface()
 Plugin  = pyPlugin()
 
-# Time loop
+# Time loop (or in batches entirely in C++ with history of residuals and
+# interface arrays, e.g. history, running = pyAdvance( 100, 1.0e-6 ), and
+# zero-copy NumPy arrays, e.g. p = Aero.view( "p" ), q = Elastic.view( "q" ))
 while Time.next():
     Mesh.next()
     Aero.next()